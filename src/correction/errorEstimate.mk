@@ -10,7 +10,7 @@ endif
 TARGET   := errorEstimate
 SOURCES  := errorEstimate.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore ../utgcns/libNDalign ../overlapErrorAdjustment
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore ../utgcns/libNDalign ../overlapErrorAdjustment ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
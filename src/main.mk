@@ -38,6 +38,7 @@ SOURCES      := AS_global.C \
                 AS_UTL/bitPackedFile.C \
                 AS_UTL/bitPackedArray.C \
                 AS_UTL/dnaAlphabets.C \
+                AS_UTL/dnaCodec.C \
                 AS_UTL/hexDump.C \
                 AS_UTL/md5.C \
                 AS_UTL/mt19937ar.C \
@@ -45,9 +46,12 @@ SOURCES      := AS_global.C \
                 AS_UTL/speedCounter.C \
                 AS_UTL/sweatShop.C \
                 AS_UTL/timeAndSize.C \
+                AS_UTL/instrumentation.C \
                 AS_UTL/kMer.C \
+                AS_UTL/kMerBlock.C \
                 \
                 falcon_sense/libfalcon/falcon.C \
+                falcon_sense/falconRecord.C \
                 correction/computeGlobalScore.C \
                 correction/falconConsensus.C \
                 correction/falconConsensus-alignTag.C \
@@ -64,23 +68,26 @@ SOURCES      := AS_global.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
+                stores/tgLayouts.C \
                 stores/tgTigSizeAnalysis.C \
                 stores/tgTigMultiAlignDisplay.C \
+                stores/tgStoreScan.C \
                 \
                 stores/libsnappy/snappy-sinksource.cc \
                 stores/libsnappy/snappy-stubs-internal.cc \
                 stores/libsnappy/snappy.cc \
                 \
                 meryl/libmeryl.C \
+                meryl/libmeryl-random.C \
                 \
                 overlapInCore/overlapReadCache.C \
                 \
                 overlapErrorAdjustment/analyzeAlignment.C \
                 \
-                overlapInCore/liboverlap/Binomial_Bound.C \
+                alignment/Binomial_Bound.C \
+                \
                 overlapInCore/liboverlap/Display_Alignment.C \
                 overlapInCore/liboverlap/prefixEditDistance.C \
-                overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
@@ -89,9 +96,7 @@ SOURCES      := AS_global.C \
                 \
                 utgcns/libNDalign/NDalign.C \
                 \
-                utgcns/libNDalign/Binomial_Bound.C \
                 utgcns/libNDalign/NDalgorithm.C \
-                utgcns/libNDalign/NDalgorithm-allocateMoreSpace.C \
                 utgcns/libNDalign/NDalgorithm-extend.C \
                 utgcns/libNDalign/NDalgorithm-forward.C \
                 utgcns/libNDalign/NDalgorithm-reverse.C \
@@ -222,6 +227,10 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 \
                 erateEstimate/erateEstimate.mk \
                 \
+                jobRunner/jobRunner.mk \
+                \
+                benchmark/kernelBenchmark.mk \
+                \
                 utgcns/utgcns.mk \
                 \
                 gfa/alignGFA.mk \
@@ -15,6 +15,7 @@ SOURCES  := meryl-args.C \
             meryl-dump.C \
             meryl-estimate.C \
             meryl-merge.C \
+            meryl-sections.C \
             meryl-unaryOp.C \
             meryl.C
 
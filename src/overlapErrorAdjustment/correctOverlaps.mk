@@ -14,7 +14,7 @@ SOURCES  := correctOverlaps.C \
             correctOverlaps-Redo_Olaps.C \
             correctOverlaps-Prefix_Edit_Distance.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
@@ -10,7 +10,7 @@ endif
 TARGET   := findErrors-Dump
 SOURCES  := findErrors-Dump.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
@@ -16,7 +16,7 @@ SOURCES  := findErrors.C \
             findErrors-Read_Frags.C \
             findErrors-Read_Olaps.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
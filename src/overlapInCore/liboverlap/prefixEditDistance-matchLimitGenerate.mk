@@ -10,7 +10,7 @@ endif
 TARGET   := prefixEditDistance-matchLimitGenerate
 SOURCES  := prefixEditDistance-matchLimitGenerate.C
 
-SRC_INCDIRS  := ../.. ../../AS_UTL ../../stores
+SRC_INCDIRS  := ../.. ../../AS_UTL ../../stores ../../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
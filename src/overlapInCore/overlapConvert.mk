@@ -10,7 +10,7 @@ endif
 TARGET   := overlapConvert
 SOURCES  := overlapConvert.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap
+SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
@@ -15,7 +15,7 @@ SOURCES  := overlapInCore.C \
             overlapInCore-Process_Overlaps.C \
             overlapInCore-Process_String_Overlaps.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap
+SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap ../alignment
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
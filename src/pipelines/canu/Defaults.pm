@@ -651,7 +651,7 @@ sub setExecDefaults ($$) {
     $synops{"${tag}StageSpace"}    = "Amount of local disk space needed to stage data for $name jobs";
 
     $global{"${tag}Concurrency"}   = undef;
-    $synops{"${tag}Concurrency"}   = "If grid not enabled, number of $name jobs to run at the same time; default is n_proc / n_threads";
+    $synops{"${tag}Concurrency"}   = "If grid not enabled, maximum number of $name jobs to run at the same time; default is as many as fit in maxThreads and maxMemory";
 }
 
 
@@ -81,7 +81,6 @@ use Config;            #  for @signame
 use Cwd qw(getcwd);
 use Carp qw(longmess);
 
-use POSIX ":sys_wait_h";  #  For waitpid(..., &WNOHANG)
 use List::Util qw(min max);
 use File::Path 2.08 qw(make_path remove_tree);
 use File::Spec;
@@ -94,125 +93,78 @@ use canu::Report   qw(generateReport);
 #
 #  Functions for running multiple processes at the same time.  This is private to the module.
 #
+#  Jobs are queued with the threads and memory they need, then handed to the jobRunner binary,
+#  which packs them onto the local cores and memory and reports the time and memory each used.
+#
 
-my $numberOfProcesses       = 0;     #  Number of jobs concurrently running
-my $numberOfProcessesToWait = 0;     #  Number of jobs we can leave running at exit
+my $concurrencyLimit        = 0;     #  Maximum number of jobs running at once, 0 for no limit
 my @processQueue            = ();
-my @processesRunning        = ();
-my $printProcessCommand     = 1;     #  Show commands as they run
 
-sub schedulerSetNumberOfProcesses {
-    $numberOfProcesses = shift @_;
+sub schedulerSetConcurrency ($) {
+    $concurrencyLimit = shift @_;
 }
 
-sub schedulerSubmit ($) {
+sub schedulerSubmit ($$$) {
     my $cmd = shift @_;
+    my $thr = shift @_;
+    my $mem = shift @_;
 
     chomp $cmd;
 
-    push @processQueue, $cmd;
-}
-
-sub schedulerForkProcess ($) {
-    my $process = shift @_;
-    my $pid;
-
-    #  From Programming Perl, page 167
-  FORK: {
-      if ($pid = fork) {
-          # Parent
-          #
-          return($pid);
-      } elsif (defined $pid) {
-          # Child
-          #
-          exec($process);
-      } elsif ($! =~ /No more processes/) {
-          # EAGIN, supposedly a recoverable fork error
-          sleep 1;
-          redo FORK;
-      } else {
-          die "Can't fork: $!\n";
-      }
-    }
-}
-
-sub schedulerReapProcess ($) {
-    my $pid = shift @_;
-
-    if (waitpid($pid, &WNOHANG) > 0) {
-        return(1);
-    } else {
-        return(0);
-    }
-}
-
-sub schedulerRun () {
-    my @running;
-
-    #  Reap any processes that have finished
-
-    foreach my $i (@processesRunning) {
-        push @running, $i  if (schedulerReapProcess($i) == 0);
-    }
-
-    @processesRunning = @running;
+    $thr = 1  if ((!defined($thr)) || ($thr < 1));
+    $mem = 0  if  (!defined($mem));
 
-    #  Run processes in any available slots
-
-    while ((scalar(@processesRunning) < $numberOfProcesses) &&
-           (scalar(@processQueue) > 0)) {
-        my $process = shift @processQueue;
-        print STDERR "    $process\n";
-        push @processesRunning, schedulerForkProcess($process);
-    }
+    push @processQueue, "$thr\t$mem\t$cmd";
 }
 
 sub schedulerFinish ($$) {
     my $dir = shift @_;
     my $nam = shift @_;
-    my $child;
-    my @newProcesses;
+    my $bin = getBinDirectory();
+    my $thr = getGlobal("maxThreads");
+    my $mem = getGlobal("maxMemory");
     my $remain;
 
     $remain = scalar(@processQueue);
 
     my $startsecs = time();
     my $diskfree  = (defined($dir)) ? (diskSpace($dir)) : (0);
+    my $limits    = (defined($thr) ? "$thr threads" : "all threads") . " and " . (defined($mem) ? "$mem GB" : "all") . " memory";
+
+    $limits .= ", $concurrencyLimit concurrently"   if ($concurrencyLimit > 0);
 
     print STDERR "----------------------------------------\n";
-    print STDERR "-- Starting '$nam' concurrent execution on ", scalar(localtime()), " with $diskfree GB free disk space ($remain processes; $numberOfProcesses concurrently)\n"  if  (defined($dir));
-    print STDERR "-- Starting '$nam' concurrent execution on ", scalar(localtime()), " ($remain processes; $numberOfProcesses concurrently)\n"                                    if (!defined($dir));
+    print STDERR "-- Starting '$nam' concurrent execution on ", scalar(localtime()), " with $diskfree GB free disk space ($remain processes; $limits)\n"  if  (defined($dir));
+    print STDERR "-- Starting '$nam' concurrent execution on ", scalar(localtime()), " ($remain processes; $limits)\n"                                    if (!defined($dir));
     print STDERR "\n";
     print STDERR "    cd $dir\n";
 
     my $cwd = getcwd();  #  Remember where we are.
     chdir($dir);        #  So we can root the jobs in the correct location.
 
-    #  Run all submitted jobs
-    #
-    while ($remain > 0) {
-        schedulerRun();
+    #  Write the jobs to a manifest, and run them.  Failed jobs are noticed by the caller, when
+    #  their outputs are missing, so the exit status of jobRunner is only reported.
 
-        $remain = scalar(@processQueue);
+    open(F, "> $nam.jobRunner.manifest") or caExit("can't open '$dir/$nam.jobRunner.manifest' for writing: $!", undef);
+    print F "$_\n"  foreach (@processQueue);
+    close(F);
 
-        if ($remain > 0) {
-            $child = waitpid -1, 0;
+    undef @processQueue;
 
-            undef @newProcesses;
-            foreach my $i (@processesRunning) {
-                push @newProcesses, $i if ($child != $i);
-            }
-            undef @processesRunning;
-            @processesRunning = @newProcesses;
-        }
-    }
+    my $cmd;
+    $cmd  = "$bin/jobRunner";
+    $cmd .= " -threads $thr"                      if (defined($thr));
+    $cmd .= " -memory $mem"                       if (defined($mem));
+    $cmd .= " -concurrency $concurrencyLimit"     if ($concurrencyLimit > 0);
+    $cmd .= " -report $nam.jobRunner.report";
+    $cmd .= " $nam.jobRunner.manifest";
 
-    #  Wait for them to finish, if requested
-    #
-    while (scalar(@processesRunning) > $numberOfProcessesToWait) {
-        waitpid(shift @processesRunning, 0);
-    }
+    print STDERR "    $cmd\n";
+    print STDERR "\n";
+
+    my $rc = 0xffff & system($cmd);
+
+    print STDERR "-- Some '$nam' jobs failed; see $dir/$nam.jobRunner.report.\n"  if ($rc != 0);
 
     chdir($cwd);
 
@@ -1253,24 +1205,17 @@ sub submitOrRunParallelJob ($$$$@) {
         }
 
         for (my $i=$st; $i<=$ed; $i++) {
-            schedulerSubmit("./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1");
+            schedulerSubmit("./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1", $thr, $mem);
         }
     }
 
-    # compute limit based on # of cpus
-    my $nCParallel  = getGlobal("${jobType}Concurrency");
-    $nCParallel     = int(getGlobal("maxThreads") / $thr)  if ((!defined($nCParallel)) || ($nCParallel == 0));
-    $nCParallel     = 1                                    if ((!defined($nCParallel)) || ($nCParallel == 0));
-
-    # compute limit based on physical memory
-    my $nMParallel = getGlobal("${jobType}Concurrency");
-    $nMParallel    = int(getGlobal("maxMemory") / getGlobal("${jobType}Memory")) if ((!defined($nMParallel)) || ($nMParallel == 0));
-    $nMParallel    = 1                                                           if ((!defined($nMParallel)) || ($nMParallel == 0));
+    #  jobRunner packs jobs onto the maxThreads cores and maxMemory memory; an explicit
+    #  concurrency further limits how many run at once.
 
-    # run min of our limits
-    my $nParallel  = $nCParallel < $nMParallel ? $nCParallel : $nMParallel;
+    my $nParallel  = getGlobal("${jobType}Concurrency");
+    $nParallel     = 0                                    if (!defined($nParallel));
 
-    schedulerSetNumberOfProcesses($nParallel);
+    schedulerSetConcurrency($nParallel);
     schedulerFinish($path, $jobType);
 }
 
@@ -265,9 +265,14 @@ sub gatekeeperCreateStore ($$@) {
     #  Load the store.
 
     if (! -e "$base/$asm.gkpStore.BUILDING") {
+        my $thr = getGlobal("maxThreads");
         my $cmd;
+
+        $thr = getNumberOfCPUs()  if (!defined($thr));
+
         $cmd .= "$bin/gatekeeperCreate \\\n";
         $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+        $cmd .= "  -t $thr \\\n";
         $cmd .= "  -o ./$asm.gkpStore.BUILDING \\\n";
         $cmd .= "  ./$asm.gkpStore.gkp \\\n";
         $cmd .= "> ./$asm.gkpStore.BUILDING.err 2>&1";
@@ -37,6 +37,7 @@ use File::Path 2.08 qw(make_path remove_tree);
 
 use canu::Defaults;
 use canu::Execution;
+use canu::Report qw(loadPerformanceReports);
 
 
 
@@ -906,6 +907,44 @@ sub buildOutputHTML ($$$$$$) {
 }
 
 
+sub buildPerformanceHTML ($$$$$$) {
+    my $base    = shift @_;
+    my $asm     = shift @_;
+    my $tag     = shift @_;
+    my $css     = shift @_;  #  Array reference
+    my $body    = shift @_;  #  Array reference
+    my $scripts = shift @_;  #  Array reference
+
+    my $perf = loadPerformanceReports();
+
+    return  if (scalar(keys %$perf) == 0);
+
+    push @$body, "<h2>Performance</h2>\n";
+    push @$body, "\n";
+    push @$body, "<table>\n";
+    push @$body, "<tr id='perfheader'><th>Program</th><th>Runs</th><th>Wall Seconds</th><th>CPU Seconds</th><th>Max Memory (GB)</th></tr>\n";
+
+    push @$scripts, "document.getElementById('perfheader').onclick = toggleTable;\n";
+    push @$scripts, "document.getElementById('perfheader').style   = 'cursor: pointer;';\n";
+
+    foreach my $prog (sort keys %$perf) {
+        my $p = $perf->{$prog};
+
+        push @$body, sprintf("<tr><td>%s</td><td>%d</td><td>%.1f</td><td>%.1f</td><td>%.2f</td></tr>\n",
+                             $prog, $p->{"runs"}, $p->{"wallTime"}, $p->{"cpuTime"}, $p->{"maxRSS"} / 1024 / 1024 / 1024);
+
+        foreach my $name (sort keys %{ $p->{"metrics"} }) {
+            my $m = $p->{"metrics"}{$name};
+
+            push @$body, sprintf("<tr class='details'><td>&nbsp;&nbsp;%s (%s)</td><td></td><td>%.1f</td><td colspan='2'>%d items</td></tr>\n",
+                                 $name, $m->{"category"}, $m->{"seconds"}, $m->{"items"});
+        }
+    }
+
+    push @$body, "</table>\n";
+}
+
+
 sub buildHTML ($$) {
     my $asm     = shift @_;
     my $tag     = shift @_;
@@ -951,6 +990,8 @@ sub buildHTML ($$) {
         buildOutputHTML($base, $asm, $tag, \@css, \@body, \@scripts);
     }
 
+    buildPerformanceHTML($base, $asm, $tag, \@css, \@body, \@scripts);
+
 
     #print STDERR "WRITING '$base/$asm-summary.html'\n";
 
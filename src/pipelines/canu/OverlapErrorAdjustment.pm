@@ -74,7 +74,8 @@ sub readErrorDetectionConfigure ($) {
 
     make_path("$path")  if (! -d "$path");
 
-    #  RED uses 13 bytes/base plus 12 bytes/overlap + space for evidence reads.
+    #  RED uses 2 bytes/base for bases and common votes, plus a few bytes/base for rare votes (about
+    #  2.5 on noisy reads, so 6 total is generous), plus 12 bytes/overlap + space for evidence reads.
 
     my @readLengths;
     my @numOlaps;
@@ -132,7 +133,7 @@ sub readErrorDetectionConfigure ($) {
         #  Guess how much extra memory used for overlapping reads.  Small genomes tend to load every read in the store,
         #  large genomes ... load repeats + 2 * coverage * bases in reads (times 2 for overlaps off of each end)
 
-        my $memory = (13 * $bases) + (12 * $olaps) + (2 * $bases * $coverage);
+        my $memory = (6 * $bases) + (12 * $olaps) + (2 * $bases * $coverage);
 
         if ((($maxMem   > 0) && ($memory >= $maxMem * 0.75)) ||    #  Allow 25% slop (10% is probably sufficient)
             (($maxReads > 0) && ($reads  >= $maxReads))      ||
@@ -143,7 +144,7 @@ sub readErrorDetectionConfigure ($) {
             printf(STDERR "RED job %3u from read %9u to read %9u - %7.3f GB for %7u reads - %7.3f GB for %9u olaps - %7.3f GB for evidence\n",
                    $nj + 1, $bgn[$nj], $end[$nj],
                    $memory / 1024 / 1024 / 1024, $reads,
-                   13 * $bases / 1024 / 1024 / 1024, $bases,
+                   6 * $bases / 1024 / 1024 / 1024, $bases,
                    12 * $olaps / 1024 / 1024 / 1024, $olaps,
                    2 * $bases * $coverage / 1024 / 1024 / 1024);
 
@@ -28,7 +28,7 @@ package canu::Report;
 require Exporter;
 
 @ISA    = qw(Exporter);
-@EXPORT = qw(generateReport addToReport getFromReport);
+@EXPORT = qw(generateReport addToReport getFromReport loadPerformanceReports);
 
 use strict;
 
@@ -38,6 +38,8 @@ use strict;
 #use canu::Defaults;
 use canu::Grid_Cloud;
 
+use JSON::PP;
+
 
 #  Holds the report we have so far (loaded from disk) and is then populated with
 #  any new results and written back to disk.
@@ -87,6 +89,8 @@ sub loadReport ($) {
         } elsif (m/CONTIGS\]$/)      {  $rpt = "contigs";         $report{$rpt} = undef;
         } elsif (m/CONSENSUS\]$/)    {  $rpt = "consensus";       $report{$rpt} = undef;
 
+        } elsif (m/PERFORMANCE\]$/)  {  $rpt = "performance";     $report{$rpt} = undef;
+
         } else {
             $report{$rpt} .= $_;
         }
@@ -137,6 +141,8 @@ sub saveReport ($) {
     saveReportItem("UNITIGGING/CONTIGS",     $report{"contigs"});
     saveReportItem("UNITIGGING/CONSENSUS",   $report{"consensus"});
 
+    saveReportItem("PERFORMANCE",            $report{"performance"});
+
     close(F);
 
     stashFile("$asm.report");
@@ -144,10 +150,77 @@ sub saveReport ($) {
 
 
 
+#  Each binary writes a JSON summary of where its time went to canu-logs/ when
+#  it exits.  Merge them into one summary per program.
+
+sub loadPerformanceReports () {
+    my %perf;
+
+    foreach my $file (sort glob("canu-logs/*.json")) {
+        my $json;
+
+        open(J, "< $file") or next;
+        { local $/;  $json = <J>; }
+        close(J);
+
+        my $r = eval { decode_json($json) };
+
+        next  if (!defined($r));
+
+        my $p = \%{ $perf{$r->{"program"}} };
+
+        $p->{"runs"}     += 1;
+        $p->{"wallTime"} += $r->{"wallTime"};
+        $p->{"cpuTime"}  += $r->{"cpuTime"};
+        $p->{"maxRSS"}    = $r->{"maxRSS"}   if ($p->{"maxRSS"} < $r->{"maxRSS"});
+
+        foreach my $m (@{ $r->{"metrics"} }) {
+            my $n = $m->{"name"};
+
+            $p->{"metrics"}{$n}{"category"}  = $m->{"category"};
+            $p->{"metrics"}{$n}{"seconds"}  += $m->{"maxThreadSeconds"};
+            $p->{"metrics"}{$n}{"items"}    += $m->{"items"};
+        }
+    }
+
+    return(\%perf);
+}
+
+
+
+sub loadPerformance () {
+    my $perf = loadPerformanceReports();
+    my $text;
+
+    return  if (scalar(keys %$perf) == 0);
+
+    $text .= "--                                    wall          cpu      max\n";
+    $text .= "--  program                 runs   seconds      seconds   memory\n";
+    $text .= "--  -------------------- ------- --------- ------------ --------\n";
+
+    foreach my $prog (sort keys %$perf) {
+        my $p = $perf->{$prog};
+
+        $text .= sprintf("--  %-20s %7d %9.1f %12.1f %6.2fGB\n", $prog, $p->{"runs"}, $p->{"wallTime"}, $p->{"cpuTime"}, $p->{"maxRSS"} / 1024 / 1024 / 1024);
+
+        foreach my $name (sort keys %{ $p->{"metrics"} }) {
+            my $m = $p->{"metrics"}{$name};
+            my $r = ($m->{"seconds"} > 0) ? $m->{"items"} / $m->{"seconds"} : 0;
+
+            $text .= sprintf("--    %-18s %-7s %9.1f %12d items %.1f/sec\n", $name, $m->{"category"}, $m->{"seconds"}, $m->{"items"}, $r);
+        }
+    }
+
+    $report{"performance"} = $text;
+}
+
+
+
 sub generateReport ($) {
     my $asm = shift @_;
 
     loadReport($asm);
+    loadPerformance();
     saveReport($asm);
 }
 